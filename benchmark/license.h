@@ -0,0 +1,17 @@
+/**
+ * \ingroup mdz_ansi_16 library
+ *
+ * \par description
+ * License data for mdz_ansi_16 benchmark. Please replace arrays below with your personal hashes (see "mdz_ansi_16 Usage" in README.md)
+ *
+ */
+
+#ifndef MDZ_ANSI_16_BENCHMARK_LICENSE_H
+#define MDZ_ANSI_16_BENCHMARK_LICENSE_H
+
+static const unsigned long pnFirstNameHash[] = { 0 /* your personal first name hash */ };
+static const unsigned long pnLastNameHash[] = { 0 /* your personal last name hash */ };
+static const unsigned long pnEmailHash[] = { 0 /* your personal email hash */ };
+static const unsigned long pnLicenseHash[] = { 0 /* your personal license hash */ };
+
+#endif
@@ -0,0 +1,511 @@
+/**
+ * \ingroup mdz_ansi_16 library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Benchmark of mdz_ansi_16 functions against standard C/C++ library equivalents (memchr, strstr, std::string_view).
+ * Covers find/rfind/firstOf/count/replace/trim/reverse on string sizes from 16 bytes up to maximal Capacity of string,
+ * with early/late/miss hit positions and different needle lengths. Results of mdz_ansi_16 functions are checked against
+ * reference results, mismatches are reported.
+ *
+ * Output is one line per case: function, size, hit position, needle length, ns/op and GB/s of mdz_ansi_16 function and of reference.
+ * GB/s is calculated from bytes which have to be scanned to produce result: up to the end of first hit for find functions, whole Data otherwise.
+ *
+ * \par build
+ * Put your license data into "license.h", then (from "benchmark" directory):
+ * Linux: g++ -std=c++17 -O2 -I.. mdz_ansi_16_benchmark.cpp -L../Linux/x64 -lmdz_ansi_16 -Wl,-rpath,'$ORIGIN/../Linux/x64' -o mdz_ansi_16_benchmark
+ * Win64: cl /std:c++17 /O2 /EHsc /I.. mdz_ansi_16_benchmark.cpp ..\Win64\mdz_ansi_16.lib
+ *
+ * \par usage
+ * mdz_ansi_16_benchmark [filter]
+ * filter - if set, only function with exactly this name is benchmarked (findSingle, rfindSingle, find, rfind, count, firstOf, replace, trim or reverse)
+ *
+ */
+
+#include <mdz_ansi_16.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "license.h"
+
+namespace
+{
+  const size_t g_pnSizes[] = { 16, 64, 256, 1024, 4096, 16384, 65530 };
+  const size_t g_pnNeedles[] = { 2, 4, 16 };
+
+  enum Hit
+  {
+    HIT_EARLY = 0,
+    HIT_LATE,
+    HIT_MISS
+  };
+
+  const char* const g_ppcHits[] = { "early", "late", "miss" };
+
+  const char g_cFill = 'a';
+  const char g_cNeedle = 'z';
+
+  /* minimal time of one measurement */
+  const std::chrono::nanoseconds g_nMinTime = std::chrono::milliseconds(20);
+
+  volatile size_t g_nSink;
+
+  /**
+   * String with buffer attached to mdz_Ansi16
+   */
+  struct Ansi
+  {
+    std::vector<char> vcBuffer;
+    mdz_Ansi16* psAnsi;
+
+    explicit Ansi(size_t nCapacity) : vcBuffer(nCapacity + 5), psAnsi(NULL)
+    {
+      enum mdz_error enError = MDZ_ERROR_NONE;
+      psAnsi = mdz_ansi_16_attach(vcBuffer.data(), (unsigned short) vcBuffer.size(), &enError);
+
+      if (NULL == psAnsi || MDZ_ERROR_NONE != enError)
+      {
+        std::fprintf(stderr, "mdz_ansi_16_attach() failed with error %d for Capacity %u\n", (int) enError, (unsigned) nCapacity);
+        std::exit(1);
+      }
+    }
+
+    void assign(const std::string_view& svData)
+    {
+      if (mdz_ansi_16_size(psAnsi) > 0)
+      {
+        mdz_ansi_16_removeFrom(psAnsi, 0, mdz_ansi_16_size(psAnsi));
+      }
+      mdz_ansi_16_insert(psAnsi, 0, svData.data(), svData.size());
+    }
+
+    std::string_view view() const
+    {
+      return std::string_view(mdz_ansi_16_dataConst(psAnsi), mdz_ansi_16_size(psAnsi));
+    }
+  };
+
+  /**
+   * Return position of needle for hit profile. SIZE_MAX for miss
+   */
+  size_t needlePosition(size_t nSize, size_t nNeedle, Hit enHit)
+  {
+    switch (enHit)
+    {
+    case HIT_EARLY:
+      return nSize / 8;
+    case HIT_LATE:
+      return nSize - nNeedle - nSize / 8;
+    default:
+      return SIZE_MAX;
+    }
+  }
+
+  /**
+   * Build data of nSize g_cFill characters with needle of nNeedle g_cNeedle characters on needle position
+   */
+  std::vector<char> makeData(size_t nSize, size_t nNeedle, Hit enHit)
+  {
+    std::vector<char> vcData(nSize + 1, g_cFill);
+    size_t nPos = needlePosition(nSize, nNeedle, enHit);
+
+    if (SIZE_MAX != nPos)
+    {
+      std::memset(vcData.data() + nPos, g_cNeedle, nNeedle);
+    }
+    vcData[nSize] = '\0';
+    return vcData;
+  }
+
+  /**
+   * Return nanoseconds per one call of fn
+   */
+  template <class Fn>
+  double measure(Fn fn)
+  {
+    size_t nIterations = 1;
+
+    for (;;)
+    {
+      std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nIterations; i++)
+      {
+        g_nSink = fn();
+      }
+      std::chrono::nanoseconds nElapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart);
+
+      if (nElapsed >= g_nMinTime)
+      {
+        return (double) nElapsed.count() / (double) nIterations;
+      }
+      nIterations *= 2;
+    }
+  }
+
+  /**
+   * Return number of bytes scanned from left by find function, which found nNeedle items on nPos (SIZE_MAX if not found)
+   */
+  size_t scannedFromLeft(size_t nSize, size_t nPos, size_t nNeedle)
+  {
+    return (SIZE_MAX == nPos) ? nSize : nPos + nNeedle;
+  }
+
+  /**
+   * Return number of bytes scanned from right by rfind function, which found items on nPos (SIZE_MAX if not found)
+   */
+  size_t scannedFromRight(size_t nSize, size_t nPos)
+  {
+    return (SIZE_MAX == nPos) ? nSize : nSize - nPos;
+  }
+
+  bool g_bMismatch = false;
+
+  void report(const char* pcFunction, size_t nSize, const char* pcHit, size_t nNeedle, size_t nBytes, double dMdz, double dReference, const char* pcReference, bool bMatch)
+  {
+    std::printf("%-14s %6zu %-5s %3zu | %10.1f ns %7.2f GB/s | %-26s %10.1f ns %7.2f GB/s%s\n",
+      pcFunction, nSize, pcHit, nNeedle,
+      dMdz, (double) nBytes / dMdz,
+      pcReference, dReference, (double) nBytes / dReference,
+      bMatch ? "" : "  MISMATCH");
+
+    if (!bMatch)
+    {
+      g_bMismatch = true;
+    }
+  }
+
+  bool enabled(const char* pcFilter, const char* pcFunction)
+  {
+    return NULL == pcFilter || 0 == std::strcmp(pcFunction, pcFilter);
+  }
+
+  void benchFindSingle(const char* pcFilter)
+  {
+    if (!enabled(pcFilter, "findSingle") && !enabled(pcFilter, "rfindSingle"))
+    {
+      return;
+    }
+
+    for (size_t nSize : g_pnSizes)
+    {
+      for (int h = HIT_EARLY; h <= HIT_MISS; h++)
+      {
+        std::vector<char> vcData = makeData(nSize, 1, (Hit) h);
+        Ansi ansi(nSize);
+        ansi.assign(std::string_view(vcData.data(), nSize));
+        std::string_view svData = ansi.view();
+        enum mdz_error enError;
+
+        if (enabled(pcFilter, "findSingle"))
+        {
+          size_t nMdz = mdz_ansi_16_findSingle(ansi.psAnsi, 0, nSize - 1, g_cNeedle, &enError);
+          const char* pcFound = (const char*) std::memchr(vcData.data(), g_cNeedle, nSize);
+          size_t nReference = (NULL == pcFound) ? SIZE_MAX : (size_t) (pcFound - vcData.data());
+
+          double dMdz = measure([&] { return mdz_ansi_16_findSingle(ansi.psAnsi, 0, nSize - 1, g_cNeedle, &enError); });
+          double dMemchr = measure([&] { return (size_t) std::memchr(vcData.data(), g_cNeedle, nSize); });
+          report("findSingle", nSize, g_ppcHits[h], 1, scannedFromLeft(nSize, nReference, 1), dMdz, dMemchr, "memchr", nMdz == nReference && MDZ_ERROR_NONE == enError);
+
+          double dView = measure([&] { return svData.find(g_cNeedle); });
+          report("findSingle", nSize, g_ppcHits[h], 1, scannedFromLeft(nSize, nReference, 1), dMdz, dView, "string_view::find", nMdz == nReference);
+        }
+
+        if (enabled(pcFilter, "rfindSingle"))
+        {
+          size_t nMdz = mdz_ansi_16_rfindSingle(ansi.psAnsi, 0, nSize - 1, g_cNeedle, &enError);
+          size_t nReference = svData.rfind(g_cNeedle);
+
+          double dMdz = measure([&] { return mdz_ansi_16_rfindSingle(ansi.psAnsi, 0, nSize - 1, g_cNeedle, &enError); });
+          double dView = measure([&] { return svData.rfind(g_cNeedle); });
+          report("rfindSingle", nSize, g_ppcHits[h], 1, scannedFromRight(nSize, nReference), dMdz, dView, "string_view::rfind", nMdz == nReference && MDZ_ERROR_NONE == enError);
+        }
+      }
+    }
+  }
+
+  void benchFind(const char* pcFilter)
+  {
+    if (!enabled(pcFilter, "find") && !enabled(pcFilter, "rfind") && !enabled(pcFilter, "count"))
+    {
+      return;
+    }
+
+    for (size_t nSize : g_pnSizes)
+    {
+      for (size_t nNeedle : g_pnNeedles)
+      {
+        if (nNeedle * 4 > nSize)
+        {
+          continue;
+        }
+
+        std::vector<char> vcNeedle(nNeedle + 1, g_cNeedle);
+        vcNeedle[nNeedle] = '\0';
+        std::string_view svNeedle(vcNeedle.data(), nNeedle);
+
+        for (int h = HIT_EARLY; h <= HIT_MISS; h++)
+        {
+          std::vector<char> vcData = makeData(nSize, nNeedle, (Hit) h);
+          Ansi ansi(nSize);
+          ansi.assign(std::string_view(vcData.data(), nSize));
+          std::string_view svData = ansi.view();
+          enum mdz_error enError;
+
+          if (enabled(pcFilter, "find"))
+          {
+            size_t nMdz = mdz_ansi_16_find(ansi.psAnsi, 0, nSize - 1, vcNeedle.data(), nNeedle, &enError);
+            size_t nReference = svData.find(svNeedle);
+
+            double dMdz = measure([&] { return mdz_ansi_16_find(ansi.psAnsi, 0, nSize - 1, vcNeedle.data(), nNeedle, &enError); });
+            double dStrstr = measure([&] { return (size_t) std::strstr(vcData.data(), vcNeedle.data()); });
+            report("find", nSize, g_ppcHits[h], nNeedle, scannedFromLeft(nSize, nReference, nNeedle), dMdz, dStrstr, "strstr", nMdz == nReference && MDZ_ERROR_NONE == enError);
+
+            double dView = measure([&] { return svData.find(svNeedle); });
+            report("find", nSize, g_ppcHits[h], nNeedle, scannedFromLeft(nSize, nReference, nNeedle), dMdz, dView, "string_view::find", nMdz == nReference);
+          }
+
+          if (enabled(pcFilter, "rfind"))
+          {
+            size_t nMdz = mdz_ansi_16_rfind(ansi.psAnsi, 0, nSize - 1, vcNeedle.data(), nNeedle, &enError);
+            size_t nReference = svData.rfind(svNeedle);
+
+            double dMdz = measure([&] { return mdz_ansi_16_rfind(ansi.psAnsi, 0, nSize - 1, vcNeedle.data(), nNeedle, &enError); });
+            double dView = measure([&] { return svData.rfind(svNeedle); });
+            report("rfind", nSize, g_ppcHits[h], nNeedle, scannedFromRight(nSize, nReference), dMdz, dView, "string_view::rfind", nMdz == nReference && MDZ_ERROR_NONE == enError);
+          }
+
+          if (enabled(pcFilter, "count"))
+          {
+            auto countView = [&]
+            {
+              size_t nCount = 0;
+              for (size_t nPos = svData.find(svNeedle); std::string_view::npos != nPos; nPos = svData.find(svNeedle, nPos + nNeedle))
+              {
+                nCount++;
+              }
+              return nCount;
+            };
+
+            size_t nMdz = mdz_ansi_16_count(ansi.psAnsi, 0, nSize - 1, vcNeedle.data(), nNeedle, mdz_false, mdz_true, &enError);
+
+            double dMdz = measure([&] { return mdz_ansi_16_count(ansi.psAnsi, 0, nSize - 1, vcNeedle.data(), nNeedle, mdz_false, mdz_true, &enError); });
+            double dView = measure(countView);
+            report("count", nSize, g_ppcHits[h], nNeedle, nSize, dMdz, dView, "string_view::find loop", nMdz == countView() && MDZ_ERROR_NONE == enError);
+          }
+        }
+      }
+    }
+  }
+
+  void benchFirstOf(const char* pcFilter)
+  {
+    if (!enabled(pcFilter, "firstOf"))
+    {
+      return;
+    }
+
+    /* set of nNeedle characters, only the last one occurs in data */
+    const char pcSet[] = "0123456789ABCDEz";
+
+    for (size_t nSize : g_pnSizes)
+    {
+      for (size_t nNeedle : g_pnNeedles)
+      {
+        const char* pcItems = pcSet + sizeof(pcSet) - 1 - nNeedle;
+        std::string_view svItems(pcItems, nNeedle);
+
+        for (int h = HIT_EARLY; h <= HIT_MISS; h++)
+        {
+          std::vector<char> vcData = makeData(nSize, 1, (Hit) h);
+          Ansi ansi(nSize);
+          ansi.assign(std::string_view(vcData.data(), nSize));
+          std::string_view svData = ansi.view();
+          enum mdz_error enError;
+
+          size_t nMdz = mdz_ansi_16_firstOf(ansi.psAnsi, 0, nSize - 1, pcItems, nNeedle, &enError);
+          size_t nReference = svData.find_first_of(svItems);
+
+          double dMdz = measure([&] { return mdz_ansi_16_firstOf(ansi.psAnsi, 0, nSize - 1, pcItems, nNeedle, &enError); });
+          double dView = measure([&] { return svData.find_first_of(svItems); });
+          report("firstOf", nSize, g_ppcHits[h], nNeedle, scannedFromLeft(nSize, nReference, 1), dMdz, dView, "string_view::find_first_of", nMdz == nReference && MDZ_ERROR_NONE == enError);
+        }
+      }
+    }
+  }
+
+  void benchReplace(const char* pcFilter)
+  {
+    if (!enabled(pcFilter, "replace"))
+    {
+      return;
+    }
+
+    for (size_t nSize : g_pnSizes)
+    {
+      for (size_t nNeedle : g_pnNeedles)
+      {
+        if (nNeedle * 4 > nSize)
+        {
+          continue;
+        }
+
+        std::vector<char> vcBefore(nNeedle, g_cNeedle);
+        std::vector<char> vcAfter(nNeedle, 'y');
+
+        for (int h = HIT_EARLY; h <= HIT_MISS; h++)
+        {
+          std::vector<char> vcData = makeData(nSize, nNeedle, (Hit) h);
+          Ansi ansi(nSize);
+          ansi.assign(std::string_view(vcData.data(), nSize));
+          std::string sData(vcData.data(), nSize);
+
+          /* replacement of same length, toggled back and forth, thus Data stays the same between iterations */
+          auto replaceMdz = [&]
+          {
+            mdz_ansi_16_replace(ansi.psAnsi, 0, nSize - 1, vcBefore.data(), nNeedle, vcAfter.data(), nNeedle, mdz_true, MDZ_ANSI_REPLACE_DUAL);
+            return (size_t) mdz_ansi_16_replace(ansi.psAnsi, 0, nSize - 1, vcAfter.data(), nNeedle, vcBefore.data(), nNeedle, mdz_true, MDZ_ANSI_REPLACE_DUAL);
+          };
+          auto replaceString = [&](const std::vector<char>& vcFrom, const std::vector<char>& vcTo)
+          {
+            std::string_view svFrom(vcFrom.data(), nNeedle);
+            for (size_t nPos = sData.find(svFrom); std::string::npos != nPos; nPos = sData.find(svFrom, nPos + nNeedle))
+            {
+              sData.replace(nPos, nNeedle, vcTo.data(), nNeedle);
+            }
+          };
+          auto replaceReference = [&]
+          {
+            replaceString(vcBefore, vcAfter);
+            replaceString(vcAfter, vcBefore);
+            return sData.size();
+          };
+
+          enum mdz_error enError = mdz_ansi_16_replace(ansi.psAnsi, 0, nSize - 1, vcBefore.data(), nNeedle, vcAfter.data(), nNeedle, mdz_true, MDZ_ANSI_REPLACE_DUAL);
+          replaceString(vcBefore, vcAfter);
+          bool bMatch = (MDZ_ERROR_NONE == enError && ansi.view() == sData);
+          ansi.assign(std::string_view(vcData.data(), nSize));
+          sData.assign(vcData.data(), nSize);
+
+          double dMdz = measure(replaceMdz) / 2;
+          double dString = measure(replaceReference) / 2;
+          report("replace", nSize, g_ppcHits[h], nNeedle, nSize, dMdz, dString, "std::string::replace loop", bMatch);
+        }
+      }
+    }
+  }
+
+  void benchTrim(const char* pcFilter)
+  {
+    if (!enabled(pcFilter, "trim"))
+    {
+      return;
+    }
+
+    const char pcItems[] = " \t";
+
+    for (size_t nSize : g_pnSizes)
+    {
+      /* nSize/8 whitespaces on both sides */
+      size_t nPad = nSize / 8;
+      std::vector<char> vcData(nSize, g_cFill);
+      std::memset(vcData.data(), ' ', nPad);
+      std::memset(vcData.data() + nSize - nPad, '\t', nPad);
+      std::vector<char> vcLeft(vcData.begin(), vcData.begin() + nPad);
+      std::vector<char> vcRight(vcData.end() - nPad, vcData.end());
+
+      Ansi ansi(nSize);
+      ansi.assign(std::string_view(vcData.data(), nSize));
+      std::string sData(vcData.data(), nSize);
+
+      /* trimmed whitespaces are inserted back after each trim, thus Data stays the same between iterations. Reference does the same modifications */
+      auto trimMdz = [&]
+      {
+        mdz_ansi_16_trim(ansi.psAnsi, 0, nSize - 1, pcItems, 2);
+        mdz_ansi_16_insert(ansi.psAnsi, 0, vcLeft.data(), nPad);
+        return (size_t) mdz_ansi_16_insert(ansi.psAnsi, mdz_ansi_16_size(ansi.psAnsi), vcRight.data(), nPad);
+      };
+      auto trimString = [&]
+      {
+        size_t nLeft = sData.find_first_not_of(pcItems);
+        size_t nRight = sData.find_last_not_of(pcItems);
+        sData.erase(nRight + 1);
+        sData.erase(0, nLeft);
+        sData.insert(0, vcLeft.data(), nPad);
+        sData.append(vcRight.data(), nPad);
+        return sData.size();
+      };
+
+      enum mdz_error enError = mdz_ansi_16_trim(ansi.psAnsi, 0, nSize - 1, pcItems, 2);
+      bool bMatch = (MDZ_ERROR_NONE == enError && ansi.view() == std::string_view(vcData.data() + nPad, nSize - 2 * nPad));
+      ansi.assign(std::string_view(vcData.data(), nSize));
+
+      double dMdz = measure(trimMdz);
+      double dString = measure(trimString);
+      bMatch = bMatch && ansi.view() == sData;
+      report("trim+2*insert", nSize, "both", 2, nSize, dMdz, dString, "std::string erase+insert", bMatch);
+    }
+  }
+
+  void benchReverse(const char* pcFilter)
+  {
+    if (!enabled(pcFilter, "reverse"))
+    {
+      return;
+    }
+
+    for (size_t nSize : g_pnSizes)
+    {
+      std::vector<char> vcData(nSize);
+      for (size_t i = 0; i < nSize; i++)
+      {
+        vcData[i] = (char) ('a' + i % 26);
+      }
+
+      Ansi ansi(nSize);
+      ansi.assign(std::string_view(vcData.data(), nSize));
+      std::vector<char> vcReference(vcData);
+
+      enum mdz_error enError = mdz_ansi_16_reverse(ansi.psAnsi, 0, nSize - 1);
+      std::vector<char> vcReversed(vcData.rbegin(), vcData.rend());
+      bool bMatch = (MDZ_ERROR_NONE == enError && ansi.view() == std::string_view(vcReversed.data(), nSize));
+
+      double dMdz = measure([&] { return (size_t) mdz_ansi_16_reverse(ansi.psAnsi, 0, nSize - 1); });
+      double dReference = measure([&] { std::reverse(vcReference.begin(), vcReference.end()); return (size_t) vcReference[0]; });
+      report("reverse", nSize, "-", 0, nSize, dMdz, dReference, "std::reverse", bMatch);
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const char* pcFilter = (argc > 1) ? argv[1] : NULL;
+
+  if (mdz_false == mdz_ansi_16_init(pnFirstNameHash, pnLastNameHash, pnEmailHash, pnLicenseHash))
+  {
+    std::fprintf(stderr, "mdz_ansi_16_init() failed, please put valid license data into \"license.h\"\n");
+    return 1;
+  }
+
+  std::printf("%-14s %6s %-5s %3s | %26s | %-26s %26s\n", "function", "size", "hit", "len", "mdz_ansi_16", "reference", "");
+
+  benchFindSingle(pcFilter);
+  benchFind(pcFilter);
+  benchFirstOf(pcFilter);
+  benchReplace(pcFilter);
+  benchTrim(pcFilter);
+  benchReverse(pcFilter);
+
+  return g_bMismatch ? 2 : 0;
+}
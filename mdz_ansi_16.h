@@ -17,6 +17,10 @@
  * Capacity - how many bytes of memory is reserved for string content.
  * Size - how many characters are actually residing in a string.
  *
+ * \par thread-safety
+ * mdz_ansi_16_init() is not thread-safe and should be completed before other library functions are called from other threads. After that, license state is only read and it is safe to call other library functions from any number of threads concurrently.
+ * Any functions may be called concurrently on distinct strings. Functions taking "const mdz_Ansi16*" may also be called concurrently on the same string, as long as no function modifying this string is running.
+ *
  * \par portability
  * Source code of library conforms to ANSI C 89/90 Standard.
  *
@@ -0,0 +1,369 @@
+/**
+ * \ingroup mdz_ansi_16 library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * C++17 header-only wrapper over mdz_ansi_16 functions. Wrapper is zero-cost: mdz::Ansi16 holds only mdz_Ansi16 pointer, does not own buffer (no RAII, no allocations, no exceptions), and each member function is one call of corresponding mdz_ansi_16 function.
+ *
+ * Items are passed as std::string_view (or as compile-time mdz::Needle), Data is returned as std::string_view without copying.
+ * Errors are returned as mdz::Result<T>: std::expected<T, mdz_error> if available (C++23), otherwise minimal equivalent with the same has_value()/value()/error() interface.
+ * Wrapper functions do not throw. Like std::expected::value(), Result::value() throws if Result holds error (std::bad_expected_access<mdz_error> with std::expected, mdz::BadResultAccess otherwise; both are derived from std::exception). Use has_value(), operator* or value_or() to access value without exceptions.
+ * Positions not found are returned as successful Result with mdz::Ansi16::npos value. Default nRightPos is npos, which means "till the end of Data" (Size-1).
+ *
+ * \par portability
+ * Requires C++17.
+ *
+ */
+
+#ifndef MDZ_ANSI_16_HPP
+#define MDZ_ANSI_16_HPP
+
+#include <cstddef>
+#include <exception>
+#include <string_view>
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_expected) && (__cpp_lib_expected >= 202202L)
+#include <expected>
+#endif
+
+#include "mdz_ansi_16.h"
+
+namespace mdz
+{
+#if defined(__cpp_lib_expected) && (__cpp_lib_expected >= 202202L)
+
+  /**
+   * Result of wrapper function: value or mdz_error
+   */
+  template <class T>
+  using Result = std::expected<T, mdz_error>;
+
+  /**
+   * Make failed Result from enError
+   */
+  inline std::unexpected<mdz_error> makeError(mdz_error enError) noexcept
+  {
+    return std::unexpected<mdz_error>(enError);
+  }
+
+#else
+
+  /**
+   * Holder of error for constructing failed Result (like std::unexpected)
+   */
+  struct Error
+  {
+    mdz_error enError;
+  };
+
+  /**
+   * Make failed Result from enError
+   */
+  constexpr Error makeError(mdz_error enError) noexcept
+  {
+    return Error{ enError };
+  }
+
+  /**
+   * Exception thrown by Result::value() if Result holds error (like std::bad_expected_access)
+   */
+  class BadResultAccess : public std::exception
+  {
+  public:
+    explicit BadResultAccess(mdz_error enError) noexcept : m_enError(enError) {}
+
+    const char* what() const noexcept override { return "mdz::Result holds error"; }
+    mdz_error error() const noexcept { return m_enError; }
+
+  private:
+    mdz_error m_enError;
+  };
+
+  /**
+   * Result of wrapper function: value or mdz_error. Minimal subset of std::expected interface, used before C++23
+   */
+  template <class T>
+  class Result
+  {
+  public:
+    constexpr Result(const T& tValue) noexcept : m_tValue(tValue), m_enError(MDZ_ERROR_NONE) {}
+    constexpr Result(Error sError) noexcept : m_tValue(), m_enError(sError.enError) {}
+
+    constexpr bool has_value() const noexcept { return MDZ_ERROR_NONE == m_enError; }
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+
+    /**
+     * Value of successful Result. Throws BadResultAccess if has_value() is false, like std::expected::value()
+     */
+    constexpr const T& value() const
+    {
+      if (!has_value())
+      {
+        throw BadResultAccess(m_enError);
+      }
+
+      return m_tValue;
+    }
+
+    /**
+     * Value of successful Result without check. Should be called only if has_value() is true
+     */
+    constexpr const T& operator*() const noexcept { return m_tValue; }
+
+    constexpr T value_or(const T& tDefault) const noexcept { return has_value() ? m_tValue : tDefault; }
+
+    /**
+     * Error of failed Result. MDZ_ERROR_NONE if has_value() is true
+     */
+    constexpr mdz_error error() const noexcept { return m_enError; }
+
+  private:
+    T m_tValue;
+    mdz_error m_enError;
+  };
+
+  /**
+   * Result of wrapper function without value
+   */
+  template <>
+  class Result<void>
+  {
+  public:
+    constexpr Result() noexcept : m_enError(MDZ_ERROR_NONE) {}
+    constexpr Result(Error sError) noexcept : m_enError(sError.enError) {}
+
+    constexpr bool has_value() const noexcept { return MDZ_ERROR_NONE == m_enError; }
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+    constexpr mdz_error error() const noexcept { return m_enError; }
+
+  private:
+    mdz_error m_enError;
+  };
+
+#endif
+
+  namespace detail
+  {
+    template <class T>
+    inline Result<T> makeResult(const T& tValue, mdz_error enError) noexcept
+    {
+      if (MDZ_ERROR_NONE != enError)
+      {
+        return makeError(enError);
+      }
+
+      return tValue;
+    }
+
+    inline Result<void> makeResult(mdz_error enError) noexcept
+    {
+      if (MDZ_ERROR_NONE != enError)
+      {
+        return makeError(enError);
+      }
+
+      return Result<void>();
+    }
+  }
+
+  /**
+   * Compile-time needle: number of items is a template constant, thus it is folded into call site and 1-item needles are dispatched to mdz_ansi_16_findSingle()/mdz_ansi_16_rfindSingle() at compile time. Needle refers to string literal without copying. Search tables are built by library on each call, as for std::string_view items. Construct from string literal, for instance: constexpr mdz::Needle sNeedle("needle");
+   */
+  template <size_t N>
+  class Needle
+  {
+  public:
+    static_assert(N > 0, "Needle cannot be empty");
+
+    constexpr Needle(const char (&pcItems)[N + 1]) noexcept : m_pcItems(pcItems) {}
+
+    constexpr const char* data() const noexcept { return m_pcItems; }
+    static constexpr size_t size() noexcept { return N; }
+    constexpr std::string_view view() const noexcept { return std::string_view(m_pcItems, N); }
+
+  private:
+    const char* m_pcItems;
+  };
+
+  template <size_t N>
+  Needle(const char (&)[N]) -> Needle<N - 1>;
+
+  /**
+   * Non-owning handle of mdz_Ansi16 string. Has the size of one pointer and can be passed by value. Buffer of string should be kept by caller as long as handle is used
+   */
+  class Ansi16
+  {
+  public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    constexpr Ansi16() noexcept : m_psAnsi(NULL) {}
+    constexpr explicit Ansi16(mdz_Ansi16* psAnsi) noexcept : m_psAnsi(psAnsi) {}
+
+    /**
+     * Attach string to pre-allocated pcBuffer (see mdz_ansi_16_attach())
+     */
+    static Result<Ansi16> attach(char* pcBuffer, unsigned short nBufferSize) noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      mdz_Ansi16* psAnsi = mdz_ansi_16_attach(pcBuffer, nBufferSize, &enError);
+      return detail::makeResult(Ansi16(psAnsi), enError);
+    }
+
+    mdz_Ansi16* get() const noexcept { return m_psAnsi; }
+
+    size_t size() const noexcept { return mdz_ansi_16_size(m_psAnsi); }
+    size_t capacity() const noexcept { return mdz_ansi_16_capacity(m_psAnsi); }
+    bool empty() const noexcept { return 0 == size(); }
+    char* data() const noexcept { return mdz_ansi_16_data(m_psAnsi); }
+
+    /**
+     * Data as std::string_view, without copying. View is invalidated by any function modifying string
+     */
+    std::string_view view() const noexcept { return std::string_view(mdz_ansi_16_dataConst(m_psAnsi), size()); }
+    operator std::string_view() const noexcept { return view(); }
+
+    Result<size_t> find(char cItem, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_findSingle(m_psAnsi, nLeftPos, right(nRightPos), cItem, &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    Result<size_t> find(std::string_view svItems, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_find(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size(), &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    template <size_t N>
+    Result<size_t> find(const Needle<N>& sNeedle, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = (1 == N) ? mdz_ansi_16_findSingle(m_psAnsi, nLeftPos, right(nRightPos), sNeedle.data()[0], &enError) : mdz_ansi_16_find(m_psAnsi, nLeftPos, right(nRightPos), sNeedle.data(), N, &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    Result<size_t> rfind(char cItem, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_rfindSingle(m_psAnsi, nLeftPos, right(nRightPos), cItem, &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    Result<size_t> rfind(std::string_view svItems, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_rfind(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size(), &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    template <size_t N>
+    Result<size_t> rfind(const Needle<N>& sNeedle, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = (1 == N) ? mdz_ansi_16_rfindSingle(m_psAnsi, nLeftPos, right(nRightPos), sNeedle.data()[0], &enError) : mdz_ansi_16_rfind(m_psAnsi, nLeftPos, right(nRightPos), sNeedle.data(), N, &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    Result<size_t> firstOf(std::string_view svItems, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_firstOf(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size(), &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    Result<size_t> lastOf(std::string_view svItems, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_lastOf(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size(), &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    Result<size_t> count(std::string_view svItems, bool bAllowOverlapped = false, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      size_t nResult = mdz_ansi_16_count(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size(), toBool(bAllowOverlapped), mdz_true, &enError);
+      return detail::makeResult(nResult, enError);
+    }
+
+    template <size_t N>
+    Result<size_t> count(const Needle<N>& sNeedle, bool bAllowOverlapped = false, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      return count(sNeedle.view(), bAllowOverlapped, nLeftPos, nRightPos);
+    }
+
+    Result<void> insert(size_t nLeftPos, std::string_view svItems) const noexcept
+    {
+      return detail::makeResult(mdz_ansi_16_insert(m_psAnsi, nLeftPos, svItems.data(), svItems.size()));
+    }
+
+    Result<void> append(std::string_view svItems) const noexcept
+    {
+      return insert(size(), svItems);
+    }
+
+    Result<void> removeFrom(size_t nLeftPos, size_t nCount) const noexcept
+    {
+      return detail::makeResult(mdz_ansi_16_removeFrom(m_psAnsi, nLeftPos, nCount));
+    }
+
+    Result<void> remove(std::string_view svItems, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      return detail::makeResult(mdz_ansi_16_remove(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size(), mdz_true));
+    }
+
+    Result<void> trim(std::string_view svItems, size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      return detail::makeResult(mdz_ansi_16_trim(m_psAnsi, nLeftPos, right(nRightPos), svItems.data(), svItems.size()));
+    }
+
+    Result<void> replace(std::string_view svItemsBefore, std::string_view svItemsAfter, size_t nLeftPos = 0, size_t nRightPos = npos, mdz_ansi_replace_type enReplacementType = MDZ_ANSI_REPLACE_DUAL) const noexcept
+    {
+      return detail::makeResult(mdz_ansi_16_replace(m_psAnsi, nLeftPos, right(nRightPos), svItemsBefore.data(), svItemsBefore.size(), svItemsAfter.data(), svItemsAfter.size(), mdz_true, enReplacementType));
+    }
+
+    template <size_t N>
+    Result<void> replace(const Needle<N>& sNeedle, std::string_view svItemsAfter, size_t nLeftPos = 0, size_t nRightPos = npos, mdz_ansi_replace_type enReplacementType = MDZ_ANSI_REPLACE_DUAL) const noexcept
+    {
+      return replace(sNeedle.view(), svItemsAfter, nLeftPos, nRightPos, enReplacementType);
+    }
+
+    Result<void> reverse(size_t nLeftPos = 0, size_t nRightPos = npos) const noexcept
+    {
+      return detail::makeResult(mdz_ansi_16_reverse(m_psAnsi, nLeftPos, right(nRightPos)));
+    }
+
+    Result<bool> compare(size_t nLeftPos, std::string_view svItems, bool bPartialCompare = false) const noexcept
+    {
+      mdz_error enError = MDZ_ERROR_NONE;
+      mdz_ansi_compare_result enResult = mdz_ansi_16_compare(m_psAnsi, nLeftPos, svItems.data(), svItems.size(), toBool(bPartialCompare), &enError);
+      return detail::makeResult(MDZ_ANSI_COMPARE_EQUAL == enResult, enError);
+    }
+
+  private:
+    size_t right(size_t nRightPos) const noexcept
+    {
+      return (npos == nRightPos) ? size() - 1 : nRightPos;
+    }
+
+    static constexpr mdz_bool toBool(bool bValue) noexcept
+    {
+      return bValue ? mdz_true : mdz_false;
+    }
+
+    mdz_Ansi16* m_psAnsi;
+  };
+}
+
+#endif